@@ -2,6 +2,11 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdint.h>
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
 
 // GLOBAL VARIABLES --------------------------------------------------------------------------------------
 typedef enum {false, true} bool; // boolean type in C
@@ -13,6 +18,7 @@ int TOTAL_CREATED_PROCESSES = 0;                // the total number of processes
 int TOTAL_FINISHED_PROCESSES = 0;               // the total number of processes that have finished
 int CURRENT_CYCLE = 0;                          // the current cycle of the scheduler
 int TOTAL_NUMBER_OF_CYCLES_SPENT_BLOCKED = 0;   // the total number of cycles spent in the blocked state
+bool VERBOSE_TRACE = true;                      // whether the schedulers print their cycle-by-cycle trace
 
 // process struct
 typedef struct Process {
@@ -39,19 +45,34 @@ typedef struct Process {
     int finishingTime;            // the time the process finished
 } _process;
 
+// partition struct, one per worker in partitioned mode (lives in shared memory)
+typedef struct Partition {
+    int processCount;             // the number of processes simulated by this partition
+    int finishingTime;            // the cycle the last process of this partition finished
+    int totalBlockedCycles;       // the total number of cycles spent blocked in this partition
+    bool completed;               // set by the worker once its results have been written
+} _partition;
+
 
 // FUNCTION PROTOTYPES -----------------------------------------------------------------------------------
-int randomOS(int upper_bound, int process_indx, FILE* random_num_file_ptr);
-uint32_t getRandNumFromFile(uint32_t line, FILE* random_num_file_ptr);
+int randomOS(int upper_bound, int process_indx, uint32_t random_numbers[], int random_number_count);
+uint32_t getRandNum(uint32_t line, uint32_t random_numbers[], int random_number_count);
+int loadRandomNumbers(FILE* random_num_file_ptr, uint32_t random_numbers[], int max_lines);
 
 void run_fcfs(_process process_list[], _process finished_process_list[]);
 void run_rr(_process process_list[], _process finished_process_list[]);
 void run_sjf(_process process_list[], _process finished_process_list[]);
+int run_partitioned(void (*scheduler)(_process[], _process[]), _process process_list[], int num_partitions);
+void simulatePartition(void (*scheduler)(_process[], _process[]), _process process_list[], int partition_idx,
+    int num_partitions, _process results[], _partition *partition);
 
 void printInput(_process process_list[]);
 void printFinal(_process finished_process_list[]);
 void printProcessSpecifics(_process process_list[]);
 void printSummaryData(_process process_list[]);
+int printPartitionedSummaryData(_process process_list[], _partition partitions[], int num_partitions);
+int percentile(int sorted_values[], int count, int pct);
+int compareInts(const void *a, const void *b);
 
 
 // MAIN FUNCTION -----------------------------------------------------------------------------------------
@@ -59,14 +80,32 @@ void printSummaryData(_process process_list[]);
 // argc is the number of command line arguments
 // argv is an array of strings (char pointers) representing the command line arguments
 // argv[0] is the name of the program, argv[1] is the first command line argument, argv[2] is the second, etc.
+// an optional argv[2] splits the processes across that many forked workers (0 means one per online core)
 int main(int argc, char *argv[])
 {
     // ensure proper command line arguments
-    if (argc != 2) {
-        fprintf(stderr, "Usage: %s <input_file>\n", argv[0]); // fprintf allows us to print to stderr instead of stdout
+    if (argc != 2 && argc != 3) {
+        fprintf(stderr, "Usage: %s <input_file> [num_partitions]\n", argv[0]); // fprintf allows us to print to stderr instead of stdout
         return 1;
     }
 
+    int num_partitions = 1;
+    if (argc == 3) {
+        char *end;
+        errno = 0;
+        long requested_partitions = strtol(argv[2], &end, 10);
+        if (end == argv[2] || *end != '\0' || errno == ERANGE || requested_partitions < 0
+            || requested_partitions > INT_MAX) {
+            fprintf(stderr, "Error: Invalid number of partitions %s\n", argv[2]);
+            return 1;
+        }
+        num_partitions = (int) requested_partitions;
+        if (num_partitions == 0) {
+            long online_cores = sysconf(_SC_NPROCESSORS_ONLN);
+            num_partitions = (online_cores > 0 && online_cores <= INT_MAX) ? (int) online_cores : 1;
+        }
+    }
+
     // open the input file
     char *input_file = argv[1];
     FILE *file_ptr = fopen(input_file, "r");
@@ -76,8 +115,12 @@ int main(int argc, char *argv[])
     }
 
     fscanf(file_ptr, "%d", &TOTAL_CREATED_PROCESSES); // read the number of processes from the file
-    _process process_list[TOTAL_CREATED_PROCESSES]; // array to hold the processes
-    _process finished_process_list[TOTAL_CREATED_PROCESSES]; // array to hold the finished processes
+    // heap allocated so very large traces don't overflow the stack
+    _process *process_list = malloc(TOTAL_CREATED_PROCESSES * sizeof(_process)); // array to hold the processes
+    if (process_list == NULL) {
+        fprintf(stderr, "Error: Could not allocate %d processes\n", TOTAL_CREATED_PROCESSES);
+        return 1;
+    }
 
     // read the processes from the file
     for (int i = 0; i < TOTAL_CREATED_PROCESSES; i++) {
@@ -87,8 +130,17 @@ int main(int argc, char *argv[])
     }
 
     fclose(file_ptr);
-    printInput(process_list);
-    
+
+    // never fork more workers than there are processes to hand out
+    if (num_partitions > TOTAL_CREATED_PROCESSES) {
+        num_partitions = TOTAL_CREATED_PROCESSES;
+    }
+    if (num_partitions > 1) {
+        VERBOSE_TRACE = false;
+    }
+
+    if (VERBOSE_TRACE) printInput(process_list);
+
     // pull random numbers for CPU bursts
     char *random_file = "random-numbers";
     file_ptr = fopen(random_file, "r");
@@ -96,19 +148,59 @@ int main(int argc, char *argv[])
         fprintf(stderr, "Error: Could not open file %s\n", random_file);
         return 1;
     }
+    // read every line the processes can use once, rather than rescanning the file per process
+    int max_random_lines = SEED_VALUE + TOTAL_CREATED_PROCESSES;
+    uint32_t *random_numbers = malloc(max_random_lines * sizeof(uint32_t));
+    if (random_numbers == NULL) {
+        fprintf(stderr, "Error: Could not allocate %d random numbers\n", max_random_lines);
+        return 1;
+    }
+    int random_number_count = loadRandomNumbers(file_ptr, random_numbers, max_random_lines);
+    fclose(file_ptr);
+
     for (int i = 0; i < TOTAL_CREATED_PROCESSES; i++) {
-        int random_number = randomOS(process_list[i].upperBound, i, file_ptr);
-        printf("Process %d random number: %d\n", i, random_number);
+        int random_number = randomOS(process_list[i].upperBound, i, random_numbers, random_number_count);
+        if (VERBOSE_TRACE) printf("Process %d random number: %d\n", i, random_number);
         process_list[i].cpuBurst = random_number;
         process_list[i].ioBurst = process_list[i].cpuBurst * process_list[i].multiplier;
     }
-    fclose(file_ptr);
+    free(random_numbers);
+
+    // partitioned mode: each scheduler runs across forked workers and only the merged summary is printed
+    if (num_partitions > 1) {
+        int status = 0;
+
+        printf("\n-------------------------------- FCFS Scheduler --------------------------------\n");
+        status = run_partitioned(run_fcfs, process_list, num_partitions);
+        printf("--------------------------------------------------------------------------------");
+
+        if (status == 0) {
+            printf("\n-------------------------------- RR Scheduler ----------------------------------\n");
+            status = run_partitioned(run_rr, process_list, num_partitions);
+            printf("--------------------------------------------------------------------------------");
+        }
+
+        if (status == 0) {
+            printf("\n-------------------------------- SJF Scheduler ---------------------------------\n");
+            status = run_partitioned(run_sjf, process_list, num_partitions);
+            printf("--------------------------------------------------------------------------------\n\n");
+        }
+
+        free(process_list);
+        return status;
+    }
 
     // duplicate process_list for each scheduling algorithm
-    _process process_list_copy1[TOTAL_CREATED_PROCESSES];
-    _process process_list_copy2[TOTAL_CREATED_PROCESSES];
-    memcpy(process_list_copy1, process_list, sizeof(process_list));
-    memcpy(process_list_copy2, process_list, sizeof(process_list));
+    size_t process_list_size = TOTAL_CREATED_PROCESSES * sizeof(_process);
+    _process *finished_process_list = malloc(process_list_size); // array to hold the finished processes
+    _process *process_list_copy1 = malloc(process_list_size);
+    _process *process_list_copy2 = malloc(process_list_size);
+    if (finished_process_list == NULL || process_list_copy1 == NULL || process_list_copy2 == NULL) {
+        fprintf(stderr, "Error: Could not allocate %d processes\n", TOTAL_CREATED_PROCESSES);
+        return 1;
+    }
+    memcpy(process_list_copy1, process_list, process_list_size);
+    memcpy(process_list_copy2, process_list, process_list_size);
 
     // run the FCFS (First Come First Serve) scheduling simulation
     printf("\n-------------------------------- FCFS Scheduler --------------------------------\n");
@@ -147,6 +239,10 @@ int main(int argc, char *argv[])
     printSummaryData(process_list_copy2);
     printf("--------------------------------------------------------------------------------\n\n");
 
+    free(process_list);
+    free(finished_process_list);
+    free(process_list_copy1);
+    free(process_list_copy2);
     return 0;
 }
 
@@ -154,37 +250,39 @@ int main(int argc, char *argv[])
 // FUNCTION DEFINITIONS ----------------------------------------------------------------------------------
 
 
-// reads a random non-negative integer X from a file named random-numbers
+// reads a random non-negative integer X loaded from the file named random-numbers
 // returns the CPU Burst: : 1 + (random-number-from-file % upper_bound)
-int randomOS(int upper_bound, int process_indx, FILE* random_num_file_ptr)
+int randomOS(int upper_bound, int process_indx, uint32_t random_numbers[], int random_number_count)
 {
-    char str[20];
-    
-    int unsigned_rand_int = (int) getRandNumFromFile(SEED_VALUE+process_indx, random_num_file_ptr);
+    int unsigned_rand_int = (int) getRandNum(SEED_VALUE+process_indx, random_numbers, random_number_count);
     int returnValue = 1 + (unsigned_rand_int % upper_bound);
 
     return returnValue;
 } 
 
 // helper function for randomOS
-// gets the random number from the file at the specified line
-uint32_t getRandNumFromFile(uint32_t line, FILE* random_num_file_ptr){
-    uint32_t end, loop;
+// gets the random number at the specified (1-based) line of the file
+uint32_t getRandNum(uint32_t line, uint32_t random_numbers[], int random_number_count){
+    if(line >= 1 && line <= (uint32_t) random_number_count) {
+        return random_numbers[line - 1];
+    }
+
+    // Fail-safe return (the file ran out before the requested line)
+    return (uint32_t) 1804289383;
+}
+
+// reads up to max_lines lines of the random-numbers file into random_numbers
+// returns the number of lines read
+int loadRandomNumbers(FILE* random_num_file_ptr, uint32_t random_numbers[], int max_lines){
+    int count = 0;
     char str[512];
 
     rewind(random_num_file_ptr); // reset to be beginning
-    for(end = loop = 0;loop<line;++loop){
-        if(0==fgets(str, sizeof(str), random_num_file_ptr)){ //include '\n'
-            end = 1;  //can't input (EOF)
-            break;
-        }
-    }
-    if(!end) {
-        return (uint32_t) atoi(str);
+    while(count < max_lines && 0!=fgets(str, sizeof(str), random_num_file_ptr)){ //include '\n'
+        random_numbers[count++] = (uint32_t) atoi(str);
     }
 
-    // Fail-safe return
-    return (uint32_t) 1804289383;
+    return count;
 }
 
 // FCFS scheduler
@@ -205,12 +303,12 @@ void run_fcfs(_process process_list[], _process finished_process_list[])
         process_list[i].finishingTime = 0;
     }
 
-    printf("\nStarting Simulation...\n");
+    if (VERBOSE_TRACE) printf("\nStarting Simulation...\n");
     CURRENT_CYCLE = 0;
 
     while(TOTAL_FINISHED_PROCESSES < TOTAL_CREATED_PROCESSES) {
 
-        printf("Cycle %d ------------------------------------\n", CURRENT_CYCLE);
+        if (VERBOSE_TRACE) printf("Cycle %d ------------------------------------\n", CURRENT_CYCLE);
 
         // check for new arrivals
         for (int i = 0; i < TOTAL_CREATED_PROCESSES; i++) {
@@ -279,17 +377,19 @@ void run_fcfs(_process process_list[], _process finished_process_list[])
         }
 
         // print states of all processes
-        for (int i = 0; i < TOTAL_CREATED_PROCESSES; i++) {
-            char* state_str;
-            switch (process_list[i].currentState) {
-                case UNSTARTED: state_str = "UNSTARTED"; break;
-                case READY: state_str = "READY"; break;
-                case RUNNING: state_str = "RUNNING"; break;
-                case BLOCKED: state_str = "BLOCKED"; break;
-                case TERMINATED: state_str = "TERMINATED"; break;
-                default: state_str = "UNKNOWN"; break;
+        if (VERBOSE_TRACE) {
+            for (int i = 0; i < TOTAL_CREATED_PROCESSES; i++) {
+                char* state_str;
+                switch (process_list[i].currentState) {
+                    case UNSTARTED: state_str = "UNSTARTED"; break;
+                    case READY: state_str = "READY"; break;
+                    case RUNNING: state_str = "RUNNING"; break;
+                    case BLOCKED: state_str = "BLOCKED"; break;
+                    case TERMINATED: state_str = "TERMINATED"; break;
+                    default: state_str = "UNKNOWN"; break;
+                }
+                printf("Process %d: %s\n", i, state_str);
             }
-            printf("Process %d: %s\n", i, state_str);
         }
 
         // process state varible updates
@@ -312,7 +412,7 @@ void run_fcfs(_process process_list[], _process finished_process_list[])
         // increment cycle
         CURRENT_CYCLE++;
     }
-    printf("---------------------------\nFCFS Scheduling Simulation Ended.\n");
+    if (VERBOSE_TRACE) printf("---------------------------\nFCFS Scheduling Simulation Ended.\n");
 }
 
 // RR scheduler
@@ -335,12 +435,12 @@ void run_rr(_process process_list[], _process finished_process_list[])
         process_list[i].finishingTime = 0;
     }
 
-    printf("\nStarting Simulation...\n");
+    if (VERBOSE_TRACE) printf("\nStarting Simulation...\n");
     CURRENT_CYCLE = 0;
 
     while (TOTAL_FINISHED_PROCESSES < TOTAL_CREATED_PROCESSES) {
 
-        printf("Cycle %d ------------------------------------\n", CURRENT_CYCLE);
+        if (VERBOSE_TRACE) printf("Cycle %d ------------------------------------\n", CURRENT_CYCLE);
 
         // check for new arrivals
         for (int i = 0; i < TOTAL_CREATED_PROCESSES; i++) {
@@ -415,17 +515,19 @@ void run_rr(_process process_list[], _process finished_process_list[])
         }
 
         // print states of all processes
-        for (int i = 0; i < TOTAL_CREATED_PROCESSES; i++) {
-            char* state_str;
-            switch (process_list[i].currentState) {
-                case UNSTARTED: state_str = "UNSTARTED"; break;
-                case READY: state_str = "READY"; break;
-                case RUNNING: state_str = "RUNNING"; break;
-                case BLOCKED: state_str = "BLOCKED"; break;
-                case TERMINATED: state_str = "TERMINATED"; break;
-                default: state_str = "UNKNOWN"; break;
+        if (VERBOSE_TRACE) {
+            for (int i = 0; i < TOTAL_CREATED_PROCESSES; i++) {
+                char* state_str;
+                switch (process_list[i].currentState) {
+                    case UNSTARTED: state_str = "UNSTARTED"; break;
+                    case READY: state_str = "READY"; break;
+                    case RUNNING: state_str = "RUNNING"; break;
+                    case BLOCKED: state_str = "BLOCKED"; break;
+                    case TERMINATED: state_str = "TERMINATED"; break;
+                    default: state_str = "UNKNOWN"; break;
+                }
+                printf("Process %d: %s\n", i, state_str);
             }
-            printf("Process %d: %s\n", i, state_str);
         }
 
         // process state varible updates
@@ -449,7 +551,7 @@ void run_rr(_process process_list[], _process finished_process_list[])
         CURRENT_CYCLE++;
     }
 
-    printf("---------------------------\nRR Scheduling Simulation Ended.\n");
+    if (VERBOSE_TRACE) printf("---------------------------\nRR Scheduling Simulation Ended.\n");
 }
 
 // SJF scheduler
@@ -470,12 +572,12 @@ void run_sjf(_process process_list[], _process finished_process_list[])
         process_list[i].finishingTime = 0;
     }
 
-    printf("\nStarting Simulation...\n");
+    if (VERBOSE_TRACE) printf("\nStarting Simulation...\n");
     CURRENT_CYCLE = 0;
 
     while (TOTAL_FINISHED_PROCESSES < TOTAL_CREATED_PROCESSES) {
 
-        printf("Cycle %d ------------------------------------\n", CURRENT_CYCLE);
+        if (VERBOSE_TRACE) printf("Cycle %d ------------------------------------\n", CURRENT_CYCLE);
 
         // check for new arrivals
         for (int i = 0; i < TOTAL_CREATED_PROCESSES; i++) {
@@ -544,17 +646,19 @@ void run_sjf(_process process_list[], _process finished_process_list[])
         }
 
         // print states of all processes
-        for (int i = 0; i < TOTAL_CREATED_PROCESSES; i++) {
-            char* state_str;
-            switch (process_list[i].currentState) {
-                case UNSTARTED: state_str = "UNSTARTED"; break;
-                case READY: state_str = "READY"; break;
-                case RUNNING: state_str = "RUNNING"; break;
-                case BLOCKED: state_str = "BLOCKED"; break;
-                case TERMINATED: state_str = "TERMINATED"; break;
-                default: state_str = "UNKNOWN"; break;
+        if (VERBOSE_TRACE) {
+            for (int i = 0; i < TOTAL_CREATED_PROCESSES; i++) {
+                char* state_str;
+                switch (process_list[i].currentState) {
+                    case UNSTARTED: state_str = "UNSTARTED"; break;
+                    case READY: state_str = "READY"; break;
+                    case RUNNING: state_str = "RUNNING"; break;
+                    case BLOCKED: state_str = "BLOCKED"; break;
+                    case TERMINATED: state_str = "TERMINATED"; break;
+                    default: state_str = "UNKNOWN"; break;
+                }
+                printf("Process %d: %s\n", i, state_str);
             }
-            printf("Process %d: %s\n", i, state_str);
         }
 
         // process state varible updates
@@ -578,7 +682,112 @@ void run_sjf(_process process_list[], _process finished_process_list[])
         CURRENT_CYCLE++;
     }
 
-    printf("---------------------------\nSJF Scheduling Simulation Ended.\n");
+    if (VERBOSE_TRACE) printf("---------------------------\nSJF Scheduling Simulation Ended.\n");
+}
+
+// partitioned scheduler
+// forks num_partitions workers, each simulating the processes whose processID hashes to it,
+// then merges the per-process results they wrote to shared memory into a single summary
+// returns 0 on success, 1 if the shared memory, a worker or the summary failed
+int run_partitioned(void (*scheduler)(_process[], _process[]), _process process_list[], int num_partitions)
+{
+    size_t results_size = TOTAL_CREATED_PROCESSES * sizeof(_process);
+    size_t partitions_size = num_partitions * sizeof(_partition);
+    _process *results = mmap(NULL, results_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    _partition *partitions = mmap(NULL, partitions_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (results == MAP_FAILED || partitions == MAP_FAILED) {
+        fprintf(stderr, "Error: Could not map shared memory for %d partitions\n", num_partitions);
+        if (results != MAP_FAILED) munmap(results, results_size);
+        if (partitions != MAP_FAILED) munmap(partitions, partitions_size);
+        return 1;
+    }
+    memset(partitions, 0, partitions_size);
+
+    // flush so the workers don't inherit (and print again) anything still buffered
+    fflush(stdout);
+
+    int started_workers = 0;
+    bool failed = false;
+    for (int p = 0; p < num_partitions; p++) {
+        pid_t pid = fork();
+        if (pid < 0) {
+            perror("fork");
+            failed = true;
+            break;
+        }
+        if (pid == 0) {
+            simulatePartition(scheduler, process_list, p, num_partitions, results, &partitions[p]);
+            _exit(0);
+        }
+        started_workers++;
+    }
+
+    // wait for every worker, even if one of them failed
+    for (int p = 0; p < started_workers; p++) {
+        int status;
+        if (wait(&status) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            failed = true;
+        }
+    }
+    for (int p = 0; p < num_partitions && !failed; p++) {
+        if (!partitions[p].completed) {
+            failed = true;
+        }
+    }
+    if (failed) {
+        fprintf(stderr, "Error: Partitioned simulation did not complete\n");
+    } else if (printPartitionedSummaryData(results, partitions, num_partitions) != 0) {
+        failed = true;
+    }
+
+    munmap(results, results_size);
+    munmap(partitions, partitions_size);
+    return failed ? 1 : 0;
+}
+
+// runs inside a forked worker
+// simulates the processes with processID % num_partitions == partition_idx and writes each of them
+// back to results[processID], then records the partition totals
+void simulatePartition(void (*scheduler)(_process[], _process[]), _process process_list[], int partition_idx,
+    int num_partitions, _process results[], _partition *partition)
+{
+    int count = 0;
+    for (int i = 0; i < TOTAL_CREATED_PROCESSES; i++) {
+        if (process_list[i].processID % num_partitions == partition_idx) {
+            count++;
+        }
+    }
+
+    _process *local_process_list = malloc(count * sizeof(_process));
+    _process *local_finished_process_list = malloc(count * sizeof(_process));
+    if (local_process_list == NULL || local_finished_process_list == NULL) {
+        fprintf(stderr, "Error: Could not allocate partition %d\n", partition_idx);
+        _exit(1);
+    }
+
+    // keep the original relative order so the processID tie-breakers behave as in a single run
+    int j = 0;
+    for (int i = 0; i < TOTAL_CREATED_PROCESSES; i++) {
+        if (process_list[i].processID % num_partitions == partition_idx) {
+            local_process_list[j++] = process_list[i];
+        }
+    }
+
+    // the globals are private to this worker after the fork
+    TOTAL_CREATED_PROCESSES = count;
+    VERBOSE_TRACE = false;
+    scheduler(local_process_list, local_finished_process_list);
+
+    for (int i = 0; i < count; i++) {
+        results[local_process_list[i].processID] = local_process_list[i];
+    }
+    partition->processCount = count;
+    partition->finishingTime = CURRENT_CYCLE - 1;
+    partition->totalBlockedCycles = TOTAL_NUMBER_OF_CYCLES_SPENT_BLOCKED;
+    partition->completed = true;
+
+    free(local_process_list);
+    free(local_finished_process_list);
 }
 
 // prints the original input to standard out
@@ -668,4 +877,98 @@ void printSummaryData(_process process_list[])
     printf("\tThroughput: %6f processes per hundred cycles\n", throughput);
     printf("\tAverage turnaround time: %6f\n", avg_turnaround_time);
     printf("\tAverage waiting time: %6f\n", avg_waiting_time);
-}
\ No newline at end of file
+}
+
+// prints out the summary data merged from every partition of a partitioned run
+// each partition is treated as its own CPU, so utilisation is averaged over num_partitions CPUs
+// returns 0 on success, 1 if the percentile buffers could not be allocated
+int printPartitionedSummaryData(_process process_list[], _partition partitions[], int num_partitions)
+{
+    double total_amount_of_time_utilizing_cpu = 0.0;
+    double total_amount_of_time_spent_waiting = 0.0;
+    double total_turnaround_time = 0.0;
+    int total_blocked_cycles = 0;
+    int final_finishing_time = 0;
+
+    for (int p = 0; p < num_partitions; p++) {
+        total_blocked_cycles += partitions[p].totalBlockedCycles;
+        if (partitions[p].finishingTime > final_finishing_time) {
+            final_finishing_time = partitions[p].finishingTime;
+        }
+    }
+
+    int *turnaround_times = malloc(TOTAL_CREATED_PROCESSES * sizeof(int));
+    int *waiting_times = malloc(TOTAL_CREATED_PROCESSES * sizeof(int));
+    if (turnaround_times == NULL || waiting_times == NULL) {
+        fprintf(stderr, "Error: Could not allocate summary data\n");
+        free(turnaround_times);
+        free(waiting_times);
+        return 1;
+    }
+    for (int i = 0; i < TOTAL_CREATED_PROCESSES; i++) {
+        turnaround_times[i] = process_list[i].finishingTime - process_list[i].arrival;
+        waiting_times[i] = process_list[i].totalWaitingTime;
+        total_amount_of_time_utilizing_cpu += process_list[i].totalCPURunTime;
+        total_amount_of_time_spent_waiting += process_list[i].totalWaitingTime;
+        total_turnaround_time += turnaround_times[i];
+    }
+    qsort(turnaround_times, TOTAL_CREATED_PROCESSES, sizeof(int), compareInts);
+    qsort(waiting_times, TOTAL_CREATED_PROCESSES, sizeof(int), compareInts);
+
+    // Calculates the CPU utilisation across all partitions
+    double cpu_util = total_amount_of_time_utilizing_cpu / ((double) final_finishing_time * num_partitions);
+
+    // Calculates the IO utilisation across all partitions
+    double io_util = (double) total_blocked_cycles / ((double) final_finishing_time * num_partitions);
+
+    // Calculates the throughput (Number of processes over the final finishing time times 100)
+    double throughput = 100 * ((double) TOTAL_CREATED_PROCESSES / final_finishing_time);
+
+    // Calculates the average turnaround time
+    double avg_turnaround_time = total_turnaround_time / TOTAL_CREATED_PROCESSES;
+
+    // Calculates the average waiting time
+    double avg_waiting_time = total_amount_of_time_spent_waiting / TOTAL_CREATED_PROCESSES;
+
+    printf("Partitioned Summary Data (%i partitions):\n", num_partitions);
+    for (int p = 0; p < num_partitions; p++) {
+        printf("\tPartition %i: %i processes, finishing time %i\n", p, partitions[p].processCount,
+               partitions[p].finishingTime);
+    }
+    printf("\tFinishing time: %i\n", final_finishing_time);
+    printf("\tCPU Utilisation: %6f\n", cpu_util);
+    printf("\tI/O Utilisation: %6f\n", io_util);
+    printf("\tThroughput: %6f processes per hundred cycles\n", throughput);
+    printf("\tAverage turnaround time: %6f\n", avg_turnaround_time);
+    printf("\tTurnaround time p50/p90/p99: %i / %i / %i\n", percentile(turnaround_times, TOTAL_CREATED_PROCESSES, 50),
+           percentile(turnaround_times, TOTAL_CREATED_PROCESSES, 90), percentile(turnaround_times, TOTAL_CREATED_PROCESSES, 99));
+    printf("\tAverage waiting time: %6f\n", avg_waiting_time);
+    printf("\tWaiting time p50/p90/p99: %i / %i / %i\n", percentile(waiting_times, TOTAL_CREATED_PROCESSES, 50),
+           percentile(waiting_times, TOTAL_CREATED_PROCESSES, 90), percentile(waiting_times, TOTAL_CREATED_PROCESSES, 99));
+
+    free(turnaround_times);
+    free(waiting_times);
+    return 0;
+}
+
+// returns the nearest-rank pct-th percentile of an ascending array of count values
+int percentile(int sorted_values[], int count, int pct)
+{
+    // long long so pct * count can't overflow on very large traces
+    long long rank = ((long long) pct * count + 99) / 100; // ceil(pct / 100 * count)
+    if (rank < 1) {
+        rank = 1;
+    }
+    if (rank > count) {
+        rank = count;
+    }
+    return sorted_values[rank - 1];
+}
+
+// qsort comparator for ascending ints
+int compareInts(const void *a, const void *b)
+{
+    int x = *(const int *) a;
+    int y = *(const int *) b;
+    return (x > y) - (x < y);
+}